@@ -0,0 +1,57 @@
+/*
+================================================================================
+    ENGINE LIBRARY INTERFACE
+    ========================
+
+    main.cpp is the whole engine. Built as usual it is main.exe, and its
+    main() calls engineMain(). Built with -DENGINE_LIBRARY it has no main()
+    and is archived as a static library; the programs in targets/ link it
+    and call one of these entry points:
+
+    - libengine.a       everything (simulation, networking, window, rendering,
+                        audio, benchmarks and tools): game.exe, bench.exe
+    - libengine_core.a  built with -DENGINE_HEADLESS_SERVER as well: the
+                        simulation, networking and tools that need only the
+                        SFML Network and System modules: server.exe,
+                        loadtest.exe
+
+    Every entry point takes main()'s arguments, parses the same options as
+    main.exe, catches exceptions (printed as critical errors) and returns
+    the process exit code.
+================================================================================
+*/
+
+#ifndef ENGINE_H
+#define ENGINE_H
+
+constexpr int ENGINE_NOT_A_TOOL = -1;                // engineRunTool(): argv[1] names no benchmark or tool
+
+/**
+ * Run a benchmark (--bench-...) or tool (--simulate, --pack-assets, --build-level,
+ * --generate-level, --bake-font, --load-test, --telemetry-view) if argv[1] names one
+ * @return Its exit code, or ENGINE_NOT_A_TOOL
+ */
+int engineRunTool(int argc, char* argv[]);
+
+/**
+ * Run the match server until its matches end (as main.exe --server)
+ */
+int engineRunServer(int argc, char* argv[]);
+
+/**
+ * Ramp bot clients up against match servers and report each stage (as main.exe
+ * --load-test); a leading number is the bot count
+ */
+int engineRunLoadTest(int argc, char* argv[]);
+
+/**
+ * Run the game until its window closes (not in libengine_core.a)
+ */
+int engineRunGame(int argc, char* argv[]);
+
+/**
+ * Everything main.exe does: a tool, else the server with --server, else the game
+ */
+int engineMain(int argc, char* argv[]);
+
+#endif  // ENGINE_H
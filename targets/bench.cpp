@@ -0,0 +1,8 @@
+// bench.exe - The benchmarks and tools, linked against libengine.a (see engine.h)
+// Without one it runs the game, which --bench-startup relaunches this program to time
+#include "../engine.h"
+
+int main(int argc, char* argv[]) {
+    const int result = engineRunTool(argc, argv);
+    return result != ENGINE_NOT_A_TOOL ? result : engineRunGame(argc, argv);
+}
@@ -0,0 +1,6 @@
+// game.exe - The game alone, linked against libengine.a (see engine.h)
+#include "../engine.h"
+
+int main(int argc, char* argv[]) {
+    return engineRunGame(argc, argv);
+}
@@ -0,0 +1,6 @@
+// loadtest.exe - Bot clients against match servers, linked against libengine_core.a (see engine.h)
+#include "../engine.h"
+
+int main(int argc, char* argv[]) {
+    return engineRunLoadTest(argc, argv);
+}
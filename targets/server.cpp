@@ -0,0 +1,6 @@
+// server.exe - The match server, linked against libengine_core.a (see engine.h)
+#include "../engine.h"
+
+int main(int argc, char* argv[]) {
+    return engineRunServer(argc, argv);
+}